@@ -64,6 +64,31 @@
 		return str ? str : '';
 	};
 
+	/* onOrientationPropertiesChanged carries the whole orientationProperties object, so the */
+	/* latest call supersedes any pending one. It is held until the current task ends so that */
+	/* repeated setOrientationProperties calls reach the container once. */
+	var _pendingOrientationURL = null;
+
+	var flushOrientationProperties = function() {
+		var url = _pendingOrientationURL;
+		_pendingOrientationURL = null;
+		if (url)
+			window.open(url);
+	};
+
+	/* Every other command is sent immediately, after any pending orientation update, */
+	/* so the container sees commands in the order the creative issued them. */
+	var sendCommand = function(command, url) {
+		if (command == 'onOrientationPropertiesChanged') {
+			if (!_pendingOrientationURL)
+				window.setTimeout(flushOrientationProperties, 0);
+			_pendingOrientationURL = url;
+		} else {
+			flushOrientationProperties();
+			window.open(url);
+		}
+	};
+
 	/* cross-platform abstraction for calling to the container. */
 	var callContainer = function(command) {
 		var args = Array.prototype.slice.call(arguments);
@@ -72,7 +97,7 @@
 			for (var i=0; i < args.length; i++)
 				args[i] = encodeURIComponent(args[i]);
 			var joinedArgs = args.join('/');
-			window.open("mraid:" + command + '/' + joinedArgs);
+			sendCommand(command, "mraid:" + command + '/' + joinedArgs);
 		} else {
 			jsBridge[command].apply(jsBridge, args);
 		}